@@ -94,11 +94,13 @@ static sc_obj* createPivot_Lit(vec3 pin, vec3 axis, float diam, float mass, vec3
 
 phys_syst* createRope(int simulate, phys_syst* system, float weight, float angle, int segments, float length) {
 
+    if (segments <= 0) failWithError("rope must have at least one segment", 0);
+
     // Create objects
-    vec3 pins[64 + 1] = {0}; // +1 for last bar
-    sc_obj* physObjs[64 + 1] = {NULL}; // +1 for weight
+    vec3* pins = calloc(segments + 1, sizeof(vec3)); // +1 for last bar
+    sc_obj** physObjs = calloc(segments + 1, sizeof(sc_obj*)); // +1 for weight
     uint nbPhysObj = segments;
-    constraint* constraints[64 + 1] = {NULL}; // +1 for weight
+    constraint** constraints = calloc(segments + 1, sizeof(constraint*)); // +1 for weight
     uint nbConstraints = segments;
     pins[0] = Vec3(0, 0.5 + length, 0);
     sc_obj* pivot = createRotule(pins[0], 0.15);
@@ -113,8 +115,11 @@ phys_syst* createRope(int simulate, phys_syst* system, float weight, float angle
     }
 
     // Create physics
-    if (!simulate) return system;
-    if (!system) failWithError("system not initialized", 0);
+    if (!simulate || !system) {
+        free(pins); free(physObjs); free(constraints);
+        if (!simulate) return system;
+        failWithError("system not initialized", 0);
+    }
 
     constraints[0] = constraintNewFixedJoint(physObjs[0], (pins[0]));
     for (uint i = 1; i < segments; i++) {
@@ -129,15 +134,13 @@ phys_syst* createRope(int simulate, phys_syst* system, float weight, float angle
         nbPhysObj++;
         nbConstraints++;
     }
-    else {
-        physObjs[segments - 1] = createMass(pins[segments - 1], 0.3, weight);
-        scobjAddLighExtData_Point(physObjs[segments - 1], Vec3(15, 0, 0), 1.0, 1.0);
-    }
+    else scobjAddLighExtData_Point(physObjs[segments - 1], Vec3(15, 0, 0), 1.0, 1.0); // No weight: the last arm ends the rope
 
     physicsSetSimulateObjects_Array(system, nbPhysObj, physObjs);
     physicsSetConstraints_Array(system, nbConstraints, constraints);
     physicsInitialize(system);
-    
+
+    free(pins); free(physObjs); free(constraints); // Copied by the system
     return system;
 }
 
@@ -180,6 +183,8 @@ phys_syst* createDoublePendulum(int simulate, phys_syst* system, float scale, fl
         constraintNewPivot(arm2, pivot3, pin3, axis)
     );
     physicsInitialize(system);
+
+    return system;
 }
 
 phys_syst* createTriplePendulum(int simulate, phys_syst* system, float scale, float angle, float weight) {
@@ -231,6 +236,119 @@ phys_syst* createTriplePendulum(int simulate, phys_syst* system, float scale, fl
         constraintNewPivot(arm3, pivot4, pin4, axis)
     );
     physicsInitialize(system);
+
+    return system;
+}
+
+phys_syst* createParallelPendulums(int simulate, phys_syst* system, uint count, float spacing, float spread, float weight) {
+
+    if (count == 0) failWithError("at least one pendulum is needed", 0);
+
+    float armLength = 1.0;
+    float rad = 0.25;
+    float width = 0.1, density = 1000.0;
+    vec3 axis = Vec3(1, 0, 0);
+
+    // Create objects
+    sc_obj** physObjs = calloc(4 * count, sizeof(sc_obj*));
+    constraint** constraints = calloc(4 * count, sizeof(constraint*));
+    vec3* pins = calloc(3 * count, sizeof(vec3));
+
+    for (uint i = 0; i < count; i++) {
+        float angle = spread * i; // Each pendulum starts slightly further from the previous one
+        vec3 pin1 = Vec3((i - (count - 1) * 0.5) * spacing, 3.5, 0);
+        createPivot(pin1, axis, rad, -1.0);
+
+        vec3 pin2 = add3(pin1, Vec3(0, 0, armLength));
+        sc_obj* arm1 = createArm(pin1, pin2, width, density);
+        sc_obj* pivot2 = createPivot(pin2, axis, rad, weight > 0 ? weight : 1.0);
+
+        vec3 pin3 = add3(pin2, Vec3(0, cos(angle * DEG_TO_RAD) * armLength, sin(angle * DEG_TO_RAD) * armLength));
+        sc_obj* arm2 = createArm(pin2, pin3, width, density);
+        sc_obj* pivot3 = createPivot(pin3, axis, rad, weight > 0 ? weight : 1.0);
+
+        physObjs[4*i + 0] = arm1;
+        physObjs[4*i + 1] = pivot2;
+        physObjs[4*i + 2] = arm2;
+        physObjs[4*i + 3] = pivot3;
+        pins[3*i + 0] = pin1;
+        pins[3*i + 1] = pin2;
+        pins[3*i + 2] = pin3;
+    }
+
+    // Create physics
+    if (!simulate || !system) {
+        free(pins); free(physObjs); free(constraints);
+        if (!simulate) return system;
+        failWithError("system not initialized", 0);
+    }
+
+    for (uint i = 0; i < count; i++) {
+        sc_obj** objs = physObjs + 4*i;
+        constraints[4*i + 0] = constraintNewFixedPivot(objs[0], pins[3*i + 0], axis);
+        constraints[4*i + 1] = constraintNewPivot(objs[0], objs[1], pins[3*i + 1], axis);
+        constraints[4*i + 2] = constraintNewPivot(objs[1], objs[2], pins[3*i + 1], axis);
+        constraints[4*i + 3] = constraintNewPivot(objs[2], objs[3], pins[3*i + 2], axis);
+    }
+
+    physicsSetSimulateObjects_Array(system, 4 * count, physObjs);
+    physicsSetConstraints_Array(system, 4 * count, constraints);
+    physicsInitialize(system);
+
+    free(pins); free(physObjs); free(constraints); // Copied by the system
+    return system;
+}
+
+phys_syst* createLattice(int simulate, phys_syst* system, uint n, float cellSize) {
+
+    if (n == 0) failWithError("lattice must have at least one cell", 0);
+
+    float width = 0.05, density = 1000.0;
+    float top = 0.5 + n * cellSize;
+    uint nbHorizontal = n * n;                  // Arm between pins (r, c) and (r, c+1), r > 0 (top row is pinned anyway)
+    uint nbArms = nbHorizontal + n * (n + 1);   // + Arm between pins (r, c) and (r+1, c)
+
+    // Create objects
+    vec3* pins = calloc((n + 1) * (n + 1), sizeof(vec3));
+    for (uint r = 0; r <= n; r++) for (uint c = 0; c <= n; c++)
+        pins[r*(n+1) + c] = Vec3((c - n * 0.5) * cellSize, top - r * cellSize, 0);
+
+    sc_obj** physObjs = calloc(nbArms, sizeof(sc_obj*));
+    for (uint r = 1; r <= n; r++) for (uint c = 0; c < n; c++)
+        physObjs[(r-1)*n + c] = createArm(pins[r*(n+1) + c], pins[r*(n+1) + c+1], width, density);
+    for (uint r = 0; r < n; r++) for (uint c = 0; c <= n; c++)
+        physObjs[nbHorizontal + r*(n+1) + c] = createArm(pins[r*(n+1) + c], pins[(r+1)*(n+1) + c], width, density);
+    for (uint c = 0; c <= n; c++) createRotule(pins[c], width * 2.0);
+
+    // Create physics
+    if (!simulate || !system) {
+        free(pins); free(physObjs);
+        if (!simulate) return system;
+        failWithError("system not initialized", 0);
+    }
+
+    // 1 fixed joint per top pin + at most 3 joints per other pin (chaining up to 4 arms)
+    constraint** constraints = calloc((n + 1) + 3 * n * (n + 1), sizeof(constraint*));
+    uint nbConstraints = 0;
+    for (uint c = 0; c <= n; c++) constraints[nbConstraints++] = constraintNewFixedJoint(physObjs[nbHorizontal + c], pins[c]);
+    for (uint r = 1; r <= n; r++) for (uint c = 0; c <= n; c++) {
+        vec3 pin = pins[r*(n+1) + c];
+        sc_obj* arms[4];
+        uint nbArmsAtPin = 0;
+        if (c > 0) arms[nbArmsAtPin++] = physObjs[(r-1)*n + c-1];
+        if (c < n) arms[nbArmsAtPin++] = physObjs[(r-1)*n + c];
+        arms[nbArmsAtPin++] = physObjs[nbHorizontal + (r-1)*(n+1) + c];
+        if (r < n) arms[nbArmsAtPin++] = physObjs[nbHorizontal + r*(n+1) + c];
+
+        for (uint k = 1; k < nbArmsAtPin; k++) constraints[nbConstraints++] = constraintNewJoint(arms[k-1], arms[k], pin);
+    }
+
+    physicsSetSimulateObjects_Array(system, nbArms, physObjs);
+    physicsSetConstraints_Array(system, nbConstraints, constraints);
+    physicsInitialize(system);
+
+    free(pins); free(physObjs); free(constraints); // Copied by the system
+    return system;
 }
 
 static sc_obj* createWheel(vec3 pin, vec3 axis, float diam, float mass) {
@@ -358,4 +476,6 @@ phys_syst* createTrebuchet(int simulate, phys_syst* system, float angle, float w
         constraintNewJoint(mass, arm15, (pin_a_3))
     );
     physicsInitialize(system);
+
+    return system;
 }
\ No newline at end of file
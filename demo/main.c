@@ -52,6 +52,8 @@ int main(int argc, const char* argv[]) {
     createDoublePendulum(checks[0], PHYSICS_SYSTEM, 1.0, 0.0, 20000.0);
     // createTriplePendulum(checks[0], PHYSICS_SYSTEM, 0.5, 30.0, 20000.0);
     // createTrebuchet(checks[0], PHYSICS_SYSTEM, 0.0, 100.0);
+    // createParallelPendulums(checks[0], PHYSICS_SYSTEM, 16, 0.75, 0.5, 20000.0);
+    // createLattice(checks[0], PHYSICS_SYSTEM, 8, 0.25);
 
     if (checks[0]) physicsStartSimulation(PHYSICS_SYSTEM, PHYSICS_ITERATIONS, PHYSICS_SUBSTEPS, PHYSICS_FACTOR);
     physicsSetSimulationState(checks[2]);